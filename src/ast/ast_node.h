@@ -20,6 +20,8 @@ enum class ASTNodeType {
     // Clauses
     FROM_CLAUSE,
     WHERE_CLAUSE,
+    ORDER_BY_CLAUSE,
+    LIMIT_CLAUSE,
     // Expressions
     LITERAL,
     IDENTIFIER,
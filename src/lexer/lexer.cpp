@@ -1,6 +1,9 @@
 #include "lexer.h"
 #include <cctype>
 #include <algorithm>
+#include <cerrno>
+#include <cmath>
+#include <cstdlib>
 
 namespace sql_interpreter {
 namespace lexer {
@@ -19,6 +22,11 @@ const std::unordered_map<std::string, TokenType> Lexer::keywords_ = {
     {"AND", TokenType::AND},
     {"OR", TokenType::OR},
     {"NOT", TokenType::NOT},
+    {"ORDER", TokenType::ORDER},
+    {"BY", TokenType::BY},
+    {"ASC", TokenType::ASC},
+    {"DESC", TokenType::DESC},
+    {"LIMIT", TokenType::LIMIT},
     {"TRUE", TokenType::BOOLEAN_LITERAL},
     {"FALSE", TokenType::BOOLEAN_LITERAL},
     {"NULL", TokenType::NULL_LITERAL}
@@ -30,17 +38,34 @@ Lexer::Lexer(const std::string& source)
 
 std::vector<Token> Lexer::tokenize() {
     std::vector<Token> tokens;
-    
+    tokenize(tokens);
+    return tokens;
+}
+
+void Lexer::tokenize(std::vector<Token>& out) {
+    out.clear();
+    do {
+        out.push_back(nextToken());
+    } while (out.back().type != TokenType::END_OF_FILE);
+}
+
+Token Lexer::nextToken() {
     while (!isAtEnd()) {
         Token token = scanToken();
-        // 只添加非 UNKNOWN 的 token，或者有实际内容的 UNKNOWN token
+        // 只返回非 UNKNOWN 的 token，或者有实际内容的 UNKNOWN token
         if (token.type != TokenType::UNKNOWN || !token.lexeme.empty()) {
-            tokens.push_back(token);
+            return token;
         }
     }
     
-    tokens.emplace_back(TokenType::END_OF_FILE, "", line_, column_);
-    return tokens;
+    return Token(TokenType::END_OF_FILE, "", line_, column_);
+}
+
+void Lexer::reset(const std::string& source) {
+    source_ = source; // 容量足够时不会重新分配
+    current_ = 0;
+    line_ = 1;
+    column_ = 1;
 }
 
 bool Lexer::isAtEnd() const {
@@ -154,14 +179,11 @@ Token Lexer::scanToken() {
 
 Token Lexer::string(char quote) {
     size_t startColumn = column_ - 1; // 调整起始列，因为引号已经被消费
-    std::string value;
-    std::string lexeme;
-    lexeme += quote;
+    size_t start = current_ - 1;      // 开始引号的位置
     
+    // 只移动位置，不逐字符拼接字符串
     while (peek() != quote && !isAtEnd()) {
-        char c = advance();
-        value += c;
-        lexeme += c;
+        advance();
     }
     
     if (isAtEnd()) {
@@ -170,65 +192,84 @@ Token Lexer::string(char quote) {
     
     // 消费结束引号
     advance();
-    lexeme += quote;
     
-    return Token(TokenType::STRING_LITERAL, lexeme, line_, startColumn, value);
+    // 一次性从源串中截取词素和值
+    std::string lexeme = source_.substr(start, current_ - start);
+    std::string value = lexeme.substr(1, lexeme.length() - 2);
+    return Token(TokenType::STRING_LITERAL, std::move(lexeme), line_, startColumn, std::move(value));
 }
 
 Token Lexer::number() {
     size_t startColumn = column_;
-    std::string lexeme;
+    size_t start = current_;
     
-    // 收集整数部分
+    // 跳过整数部分
     while (isDigit(peek())) {
-        lexeme += advance();
+        advance();
     }
     
     // 查看是否有小数点
     if (peek() == '.' && isDigit(peekNext())) {
-        lexeme += advance(); // 消费小数点
+        advance(); // 消费小数点
         
-        // 收集小数部分
+        // 跳过小数部分
         while (isDigit(peek())) {
-            lexeme += advance();
+            advance();
         }
     }
     
-    double value = std::stod(lexeme);
-    return Token(TokenType::NUMERIC_LITERAL, lexeme, line_, startColumn, value);
+    std::string lexeme = source_.substr(start, current_ - start);
+    // 用 strtod 而不是 stod：下溢（极小值）得到 0 或次正规数，只有上溢才报错
+    errno = 0;
+    double value = std::strtod(lexeme.c_str(), nullptr);
+    if (errno == ERANGE && std::isinf(value)) {
+        return errorToken("Numeric literal out of range");
+    }
+    return Token(TokenType::NUMERIC_LITERAL, std::move(lexeme), line_, startColumn, value);
 }
 
 Token Lexer::identifier() {
     size_t startColumn = column_;
-    std::string lexeme;
+    size_t start = current_;
     
-    // 收集标识符字符
+    // 跳过标识符字符
     while (isAlphaNumeric(peek()) || peek() == '_') {
-        lexeme += advance();
+        advance();
     }
     
-    // 转换为大写以检查关键字
-    std::string upperLexeme = lexeme;
-    std::transform(upperLexeme.begin(), upperLexeme.end(), 
-                   upperLexeme.begin(), ::toupper);
+    std::string lexeme = source_.substr(start, current_ - start);
+    
+    // 比最长关键字还长的标识符不可能是关键字，无需再做大写副本
+    static const size_t maxKeywordLength = std::max_element(
+        keywords_.begin(), keywords_.end(),
+        [](const auto& a, const auto& b) { return a.first.length() < b.first.length(); }
+    )->first.length();
     
-    // 检查是否是关键字
-    auto it = keywords_.find(upperLexeme);
-    if (it != keywords_.end()) {
-        TokenType type = it->second;
+    if (lexeme.length() <= maxKeywordLength) {
+        // 转换为大写以检查关键字
+        std::string upperLexeme = lexeme;
+        std::transform(upperLexeme.begin(), upperLexeme.end(), 
+                       upperLexeme.begin(), ::toupper);
         
-        if (type == TokenType::BOOLEAN_LITERAL) {
-            bool value = (upperLexeme == "TRUE");
-            return Token(type, lexeme, line_, startColumn, value);
-        } else if (type == TokenType::NULL_LITERAL) {
-            return Token(type, lexeme, line_, startColumn, nullptr);
-        } else {
-            return Token(type, lexeme, line_, startColumn);
+        // 检查是否是关键字
+        auto it = keywords_.find(upperLexeme);
+        if (it != keywords_.end()) {
+            TokenType type = it->second;
+            
+            if (type == TokenType::BOOLEAN_LITERAL) {
+                bool value = (upperLexeme == "TRUE");
+                return Token(type, std::move(lexeme), line_, startColumn, value);
+            } else if (type == TokenType::NULL_LITERAL) {
+                return Token(type, std::move(lexeme), line_, startColumn, nullptr);
+            } else {
+                return Token(type, std::move(lexeme), line_, startColumn);
+            }
         }
     }
     
-    // 不是关键字，返回标识符
-    return Token(TokenType::IDENTIFIER, lexeme, line_, startColumn, lexeme);
+    // 不是关键字，返回标识符：字面量复制一份，词素直接移入
+    std::string value = lexeme;
+    return Token(TokenType::IDENTIFIER, std::move(lexeme), line_, startColumn, std::move(value));
 }
 
 bool Lexer::isDigit(char c) const {
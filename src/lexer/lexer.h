@@ -16,6 +16,15 @@ public:
     // 主要的词法分析方法
     std::vector<Token> tokenize();
     
+    // 复用调用方的缓冲区：先清空 out，再写入全部 Token（保留已有容量）
+    void tokenize(std::vector<Token>& out);
+    
+    // 流式接口：每次返回下一个 Token，结束后持续返回 END_OF_FILE
+    Token nextToken();
+    
+    // 换一条新的 SQL 复用同一个 Lexer，尽量复用已分配的内存
+    void reset(const std::string& source);
+    
 private:
     std::string source_;
     size_t current_;
@@ -18,6 +18,11 @@ std::string tokenTypeToString(TokenType type) {
         case TokenType::AND: return "AND";
         case TokenType::OR: return "OR";
         case TokenType::NOT: return "NOT";
+        case TokenType::ORDER: return "ORDER";
+        case TokenType::BY: return "BY";
+        case TokenType::ASC: return "ASC";
+        case TokenType::DESC: return "DESC";
+        case TokenType::LIMIT: return "LIMIT";
         case TokenType::IDENTIFIER: return "IDENTIFIER";
         case TokenType::STRING_LITERAL: return "STRING_LITERAL";
         case TokenType::NUMERIC_LITERAL: return "NUMERIC_LITERAL";
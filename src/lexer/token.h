@@ -4,6 +4,7 @@
 #include <string>
 #include <variant> // Ensure std::variant is available
 #include <cstddef> // For std::nullptr_t
+#include <utility> // For std::move
 
 namespace sql_interpreter {
 namespace lexer {
@@ -12,6 +13,7 @@ namespace lexer {
 enum class TokenType {
     // Keywords
     SELECT, FROM, WHERE, INSERT, INTO, VALUES, CREATE, TABLE, AS, AND, OR, NOT,
+    ORDER, BY, ASC, DESC, LIMIT,
     // Identifiers (table names, column names, etc.)
     IDENTIFIER,
     // Literals
@@ -55,9 +57,11 @@ struct Token {
     int line;           // Line number where the token appears
     int column;         // Column number where the token begins
 
-    Token(TokenType type, const std::string& lexeme, int line, int col, 
+    // lexeme and literal_val are taken by value and moved in, so callers that pass
+    // temporaries (e.g. substrings of the source) do not pay for a second copy.
+    Token(TokenType type, std::string lexeme, int line, int col, 
           std::variant<std::string, double, bool, std::nullptr_t> literal_val = std::nullptr_t())
-        : type(type), lexeme(lexeme), literal(literal_val), line(line), column(col) {}
+        : type(type), lexeme(std::move(lexeme)), literal(std::move(literal_val)), line(line), column(col) {}
 
     std::string toString() const;
 };
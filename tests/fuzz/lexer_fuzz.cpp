@@ -0,0 +1,27 @@
+#include "lexer/lexer.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <string>
+
+using namespace sql_interpreter::lexer;
+
+// libFuzzer entry point: feeds arbitrary bytes to Lexer::tokenize() and checks
+// the invariants every token stream must satisfy.
+// Build with: cmake -DCMAKE_CXX_COMPILER=clang++ -DBUILD_FUZZERS=ON ..
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t* data, size_t size) {
+    std::string sql(reinterpret_cast<const char*>(data), size);
+    Lexer lexer(sql);
+    auto tokens = lexer.tokenize();
+
+    // 每个 token 至少消费一个字符，最后总是 END_OF_FILE
+    if (tokens.empty() || tokens.size() > size + 1) std::abort();
+    if (tokens.back().type != TokenType::END_OF_FILE) std::abort();
+    for (size_t i = 0; i + 1 < tokens.size(); ++i) {
+        if (tokens[i].type == TokenType::END_OF_FILE) std::abort();
+        if (tokens[i].line < 1 || tokens[i].column < 1) std::abort();
+    }
+
+    return 0;
+}
@@ -0,0 +1,175 @@
+#include <catch2/catch_test_macros.hpp>
+#include "lexer/lexer.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <new>
+#include <string>
+
+using namespace sql_interpreter::lexer;
+
+// Counting global allocator hook: every operator new in this binary bumps the
+// counter, so a test can measure how many allocations a single call performs.
+namespace {
+std::atomic<size_t> g_allocationCount{0};
+}
+
+void* operator new(std::size_t size) {
+    g_allocationCount.fetch_add(1, std::memory_order_relaxed);
+    if (void* p = std::malloc(size == 0 ? 1 : size)) return p;
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size) {
+    return ::operator new(size);
+}
+
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete[](void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+void operator delete[](void* p, std::size_t) noexcept { std::free(p); }
+
+namespace {
+
+// Budgets for the front end. Inputs are generated, so these hold for any size.
+constexpr double kMaxAllocationsPerByte = 0.5;
+constexpr size_t kMaxAllocationsPerLongToken = 16;
+// Growing the input 8x may cost at most this much more time before the
+// behaviour is flagged as super-linear (a quadratic path would be ~64x).
+// The slack absorbs cache and page-fault effects on the larger input.
+constexpr size_t kScaleFactor = 8;
+constexpr double kMaxTimeRatio = kScaleFactor * 4.0;
+// Worst-case wall time per input byte, loose enough for unoptimized builds
+constexpr double kMaxSecondsPerByte = 10e-6;
+// Below this the timer resolution dominates the measurement
+constexpr double kMinMeasurableSeconds = 1e-3;
+
+struct Measurement {
+    size_t allocations;
+    size_t tokens;
+};
+
+Measurement tokenizeCounting(const std::string& sql) {
+    Lexer lexer(sql);
+    size_t before = g_allocationCount.load();
+    auto tokens = lexer.tokenize();
+    size_t after = g_allocationCount.load();
+    return {after - before, tokens.size()};
+}
+
+double bestSecondsToTokenize(const std::string& sql) {
+    double best = 1e9;
+    for (int run = 0; run < 3; ++run) {
+        auto start = std::chrono::steady_clock::now();
+        Lexer lexer(sql);
+        auto tokens = lexer.tokenize();
+        auto end = std::chrono::steady_clock::now();
+        best = std::min(best, std::chrono::duration<double>(end - start).count());
+    }
+    return best;
+}
+
+void checkLinearScaling(const std::function<std::string(size_t)>& makeInput, size_t baseSize) {
+    std::string largeInput = makeInput(baseSize * kScaleFactor);
+    double small = bestSecondsToTokenize(makeInput(baseSize));
+    double large = bestSecondsToTokenize(largeInput);
+    INFO("small: " << small << "s, large: " << large << "s");
+    CHECK(large <= std::max(small, kMinMeasurableSeconds) * kMaxTimeRatio);
+    CHECK(large / largeInput.size() <= kMaxSecondsPerByte);
+}
+
+std::string longStringLiteral(size_t bytes) {
+    return "SELECT '" + std::string(bytes, 'x') + "';";
+}
+
+std::string nestedParens(size_t depth) {
+    return "SELECT " + std::string(depth, '(') + "1" + std::string(depth, ')') + ";";
+}
+
+std::string tinyStatements(size_t count) {
+    std::string sql;
+    sql.reserve(count * 2);
+    for (size_t i = 0; i < count; ++i) {
+        sql += "a;";
+    }
+    return sql;
+}
+
+} // namespace
+
+TEST_CASE("100 KB string literal", "[lexer][stress]") {
+    std::string sql = longStringLiteral(100 * 1024);
+    Measurement m = tokenizeCounting(sql);
+
+    REQUIRE(m.tokens == 4);
+    CHECK(m.allocations <= kMaxAllocationsPerLongToken);
+
+    checkLinearScaling(longStringLiteral, 1024 * 1024);
+}
+
+TEST_CASE("Long identifiers and numbers", "[lexer][stress]") {
+    SECTION("Identifier") {
+        Lexer lexer("SELECT " + std::string(100 * 1024, 'c') + ";");
+        size_t before = g_allocationCount.load();
+        auto tokens = lexer.tokenize();
+        size_t after = g_allocationCount.load();
+
+        REQUIRE(tokens.size() == 4);
+        REQUIRE(tokens[1].type == TokenType::IDENTIFIER);
+        CHECK(after - before <= kMaxAllocationsPerLongToken);
+    }
+
+    SECTION("Numeric literal") {
+        Lexer lexer("SELECT 0." + std::string(100 * 1024, '7') + ";");
+        size_t before = g_allocationCount.load();
+        auto tokens = lexer.tokenize();
+        size_t after = g_allocationCount.load();
+
+        REQUIRE(tokens.size() == 4);
+        REQUIRE(tokens[1].type == TokenType::NUMERIC_LITERAL);
+        CHECK(after - before <= kMaxAllocationsPerLongToken);
+    }
+}
+
+TEST_CASE("Deeply nested parentheses", "[lexer][stress]") {
+    // The lexer is iterative, so nesting depth must not affect the call stack
+    const size_t depth = 1000 * 1000;
+    std::string sql = nestedParens(depth);
+    Measurement m = tokenizeCounting(sql);
+
+    REQUIRE(m.tokens == 2 * depth + 4);
+    CHECK(static_cast<double>(m.allocations) / sql.size() <= kMaxAllocationsPerByte);
+
+    checkLinearScaling(nestedParens, 128 * 1024);
+}
+
+TEST_CASE("Millions of tiny statements", "[lexer][stress]") {
+    const size_t count = 1000 * 1000;
+    std::string sql = tinyStatements(count);
+    Measurement m = tokenizeCounting(sql);
+
+    REQUIRE(m.tokens == 2 * count + 1);
+    CHECK(static_cast<double>(m.allocations) / sql.size() <= kMaxAllocationsPerByte);
+
+    checkLinearScaling(tinyStatements, 128 * 1024);
+}
+
+TEST_CASE("Steady-state reuse does not allocate", "[lexer][stress]") {
+    std::string first = "SELECT id, status FROM orders WHERE total >= 100 ORDER BY total DESC LIMIT 50;";
+    std::string second = "SELECT name FROM users WHERE active = true LIMIT 10;";
+    Lexer lexer(first);
+    std::vector<Token> tokens;
+    lexer.tokenize(tokens);
+
+    size_t before = g_allocationCount.load();
+    for (int i = 0; i < 100; ++i) {
+        lexer.reset(i % 2 == 0 ? second : first);
+        lexer.tokenize(tokens);
+    }
+    size_t after = g_allocationCount.load();
+
+    CHECK(after - before == 0);
+}
@@ -139,3 +139,69 @@ TEST_CASE("Case insensitive keywords", "[lexer][keywords]") {
     CHECK(tokens[4].type == TokenType::WHERE);
     CHECK(tokens[4].lexeme == "where");
 }
+
+TEST_CASE("ORDER BY and LIMIT keywords", "[lexer][keywords]") {
+    Lexer lexer("SELECT id FROM orders ORDER BY total desc, id Asc LIMIT 50;");
+    auto tokens = lexer.tokenize();
+
+    REQUIRE(tokens.size() == 15);
+    CHECK(tokens[4].type == TokenType::ORDER);
+    CHECK(tokens[5].type == TokenType::BY);
+    CHECK(tokens[6].type == TokenType::IDENTIFIER);
+    CHECK(tokens[7].type == TokenType::DESC);
+    CHECK(tokens[7].lexeme == "desc");
+    CHECK(tokens[10].type == TokenType::ASC);
+    CHECK(tokens[11].type == TokenType::LIMIT);
+    CHECK(tokens[12].type == TokenType::NUMERIC_LITERAL);
+    CHECK(tokens[12].lexeme == "50");
+    CHECK(tokenTypeToString(TokenType::LIMIT) == "LIMIT");
+}
+
+TEST_CASE("Out of range numeric literal", "[lexer][numbers]") {
+    Lexer lexer("SELECT " + std::string(400, '9') + ";");
+    auto tokens = lexer.tokenize();
+
+    REQUIRE(tokens.size() == 4);
+    CHECK(tokens[1].type == TokenType::UNKNOWN);
+    CHECK(tokens[2].type == TokenType::SEMICOLON);
+}
+
+TEST_CASE("Underflowing numeric literal", "[lexer][numbers]") {
+    Lexer lexer("SELECT 0." + std::string(330, '0') + "1;");
+    auto tokens = lexer.tokenize();
+
+    REQUIRE(tokens.size() == 4);
+    CHECK(tokens[1].type == TokenType::NUMERIC_LITERAL);
+    CHECK(std::get<double>(tokens[1].literal) >= 0.0);
+    CHECK(std::get<double>(tokens[1].literal) < 1e-300);
+    CHECK(tokens[2].type == TokenType::SEMICOLON);
+}
+
+TEST_CASE("Streaming and buffer reuse", "[lexer][streaming]") {
+    Lexer lexer("SELECT a FROM t;");
+
+    SECTION("nextToken matches tokenize") {
+        auto expected = Lexer("SELECT a FROM t;").tokenize();
+        for (const auto& token : expected) {
+            Token next = lexer.nextToken();
+            CHECK(next.type == token.type);
+            CHECK(next.lexeme == token.lexeme);
+        }
+        // 结束后持续返回 END_OF_FILE
+        CHECK(lexer.nextToken().type == TokenType::END_OF_FILE);
+    }
+
+    SECTION("reset and tokenize into an existing buffer") {
+        std::vector<Token> tokens;
+        lexer.tokenize(tokens);
+        REQUIRE(tokens.size() == 6);
+
+        lexer.reset("DELETE\nx");
+        lexer.tokenize(tokens);
+        REQUIRE(tokens.size() == 3);
+        CHECK(tokens[0].lexeme == "DELETE");
+        CHECK(tokens[1].line == 2);
+        CHECK(tokens[1].column == 1);
+        CHECK(tokens[2].type == TokenType::END_OF_FILE);
+    }
+}